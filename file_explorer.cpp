@@ -5,6 +5,8 @@
 #include <sys/stat.h>
 #include <unistd.h>
 #include <cstring>
+#include <cerrno>
+#include <cstdlib>
 #include <fstream>
 #include <algorithm>
 #include <iomanip>
@@ -12,6 +14,17 @@
 #include <ctime>
 #include <map>
 #include <limits>
+#include <fcntl.h>
+#include <fnmatch.h>
+#include <pwd.h>
+#include <grp.h>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <memory>
+#include <system_error>
 
 using namespace std;
 
@@ -56,6 +69,48 @@ public:
     }
 };
 
+// Recursive walk shared by the statistics dashboard and both searches. What the
+// loop does per entry is fixed at compile time by the visitor's flags:
+//   needsStat       - stat() every entry and skip entries it fails on.
+//   needsSize       - st_size is needed for regular files only.
+//   needsMtime      - st_mtime is needed for regular files only.
+//   recurseIntoDirs - descend into subdirectories.
+// Without needsStat the struct is zeroed and the file type bits of st_mode come
+// from d_type. stat() is then called only for symlinks and DT_UNKNOWN entries,
+// and for regular files when needsSize or needsMtime is set; entries it fails
+// on are skipped in that case and passed with a zero st_mode otherwise.
+template <typename Visitor>
+void traverseDirectory(const string& path, Visitor& visitor) {
+    constexpr bool statFiles = Visitor::needsSize || Visitor::needsMtime;
+    DIR* dir = opendir(path.c_str());
+    if (!dir) return;
+    struct dirent* entry;
+    struct stat fileStat;
+    while ((entry = readdir(dir)) != NULL) {
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
+        string fullPath = path + "/" + entry->d_name;
+        if constexpr (Visitor::needsStat) {
+            if (stat(fullPath.c_str(), &fileStat) != 0) continue;
+        } else {
+            fileStat = {};
+            if (entry->d_type != DT_UNKNOWN && entry->d_type != DT_LNK) {
+                fileStat.st_mode = DTTOIF(entry->d_type);
+                if constexpr (statFiles) {
+                    if (S_ISREG(fileStat.st_mode) && stat(fullPath.c_str(), &fileStat) != 0) continue;
+                }
+            } else if (stat(fullPath.c_str(), &fileStat) != 0) {
+                if constexpr (statFiles) continue;
+                fileStat = {};
+            }
+        }
+        visitor.visit(fullPath, entry->d_name, fileStat);
+        if constexpr (Visitor::recurseIntoDirs) {
+            if (S_ISDIR(fileStat.st_mode)) traverseDirectory(fullPath, visitor);
+        }
+    }
+    closedir(dir);
+}
+
 class FileStatistics {
 public:
     int totalFiles = 0;
@@ -68,36 +123,27 @@ public:
         totalDirs = 0;
         totalSize = 0;
         extensionCount.clear();
-        analyzeDirectory(path);
+        traverseDirectory(path, *this);
     }
 
-    void analyzeDirectory(const string& path) {
-        DIR* dir = opendir(path.c_str());
-        if (!dir) return;
-        struct dirent* entry;
-        struct stat fileStat;
-        while ((entry = readdir(dir)) != NULL) {
-            if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
-            string fullPath = path + "/" + entry->d_name;
-            if (stat(fullPath.c_str(), &fileStat) == 0) {
-                if (S_ISDIR(fileStat.st_mode)) {
-                    totalDirs++;
-                    analyzeDirectory(fullPath);
-                } else if (S_ISREG(fileStat.st_mode)) {
-                    totalFiles++;
-                    totalSize += fileStat.st_size;
-                    string name = entry->d_name;
-                    size_t dotPos = name.find_last_of('.');
-                    if (dotPos != string::npos) {
-                        string ext = name.substr(dotPos);
-                        extensionCount[ext]++;
-                    } else {
-                        extensionCount["(no_ext)"]++;
-                    }
-                }
+    static constexpr bool needsStat = false;
+    static constexpr bool needsSize = true;
+    static constexpr bool needsMtime = false;
+    static constexpr bool recurseIntoDirs = true;
+
+    void visit(const string&, const char* name, const struct stat& fileStat) {
+        if (S_ISDIR(fileStat.st_mode)) {
+            totalDirs++;
+        } else if (S_ISREG(fileStat.st_mode)) {
+            totalFiles++;
+            totalSize += fileStat.st_size;
+            const char* dot = strrchr(name, '.');
+            if (dot) {
+                extensionCount[dot]++;
+            } else {
+                extensionCount["(no_ext)"]++;
             }
         }
-        closedir(dir);
     }
 
     void display() {
@@ -130,11 +176,366 @@ public:
     }
 };
 
+// Simple search only needs names, so it never stats regular files.
+struct NameSearchVisitor {
+    static constexpr bool needsStat = false;
+    static constexpr bool needsSize = false;
+    static constexpr bool needsMtime = false;
+    static constexpr bool recurseIntoDirs = true;
+
+    const string& searchName;
+    bool found = false;
+
+    void visit(const string& fullPath, const char* name, const struct stat&) {
+        if (strstr(name, searchName.c_str())) {
+            cout << "Found: " << fullPath << "\n";
+            found = true;
+        }
+    }
+};
+
+// The name and extension filters are template parameters so that each
+// combination gets its own loop without per-file checks for unused filters.
+template <bool FilterName, bool FilterExt>
+struct AdvancedSearchVisitor {
+    static constexpr bool needsStat = false;
+    static constexpr bool needsSize = true;
+    static constexpr bool needsMtime = false;
+    static constexpr bool recurseIntoDirs = true;
+
+    const string& pattern;
+    const string& ext;
+    long long minSize;
+    long long maxSize;
+    FileStatistics& stats;
+    bool found = false;
+
+    void visit(const string& fullPath, const char* name, const struct stat& fileStat) {
+        if (!S_ISREG(fileStat.st_mode)) return;
+        if constexpr (FilterName) {
+            if (!strstr(name, pattern.c_str())) return;
+        }
+        if constexpr (FilterExt) {
+            if (!strstr(name, ext.c_str())) return;
+        }
+        if (fileStat.st_size < minSize || fileStat.st_size > maxSize) return;
+        cout << fullPath << " (" << stats.formatSize(fileStat.st_size) << ")\n";
+        found = true;
+    }
+};
+
+class PermissionSpec {
+private:
+    struct Clause {
+        mode_t who;
+        mode_t umaskBits;
+        char op;
+        mode_t perms;
+        bool conditionalExec;
+        bool namesSetId;
+    };
+
+    bool absolute = false;
+    bool clearsDirSetId = false;
+    mode_t absoluteMode = 0;
+    vector<Clause> clauses;
+
+public:
+    // Accepts octal ("755") or symbolic clauses ("u+x,go-w,a=rX").
+    // Symbolic clauses only touch the bits they name, so the rest of the mode is kept.
+    // A clause without u/g/o/a applies to everyone minus the umask, like chmod(1).
+    // As in chmod(1), directories keep setuid/setgid unless the octal mode has
+    // five digits (e.g. 00755) or an '=' clause names 's'.
+    bool parse(const string& spec) {
+        absolute = false;
+        clearsDirSetId = false;
+        absoluteMode = 0;
+        clauses.clear();
+        if (spec.empty()) return false;
+        if (spec.find_first_not_of("01234567") == string::npos) {
+            if (spec.size() > 5) return false;
+            absolute = true;
+            clearsDirSetId = spec.size() == 5;
+            absoluteMode = (mode_t)stoi(spec, nullptr, 8);
+            return absoluteMode <= 07777;
+        }
+        size_t i = 0;
+        while (i < spec.size()) {
+            mode_t who = 0;
+            while (i < spec.size() && strchr("ugoa", spec[i])) {
+                if (spec[i] == 'u') who |= S_ISUID | S_IRWXU;
+                else if (spec[i] == 'g') who |= S_ISGID | S_IRWXG;
+                else if (spec[i] == 'o') who |= S_ISVTX | S_IRWXO;
+                else who |= 07777;
+                i++;
+            }
+            mode_t umaskBits = 0;
+            if (who == 0) {
+                who = 07777;
+                umaskBits = umask(0);
+                umask(umaskBits);
+            }
+            if (i >= spec.size() || !strchr("+-=", spec[i])) return false;
+            while (i < spec.size() && strchr("+-=", spec[i])) {
+                Clause clause = {who, umaskBits, spec[i++], 0, false, false};
+                while (i < spec.size() && strchr("rwxXst", spec[i])) {
+                    if (spec[i] == 'r') clause.perms |= S_IRUSR | S_IRGRP | S_IROTH;
+                    else if (spec[i] == 'w') clause.perms |= S_IWUSR | S_IWGRP | S_IWOTH;
+                    else if (spec[i] == 'x') clause.perms |= S_IXUSR | S_IXGRP | S_IXOTH;
+                    else if (spec[i] == 'X') clause.conditionalExec = true;
+                    else if (spec[i] == 's') {
+                        clause.perms |= S_ISUID | S_ISGID;
+                        clause.namesSetId = true;
+                    }
+                    else clause.perms |= S_ISVTX;
+                    i++;
+                }
+                clauses.push_back(clause);
+            }
+            if (i < spec.size()) {
+                if (spec[i] != ',' || i + 1 == spec.size()) return false;
+                i++;
+            }
+        }
+        return !clauses.empty();
+    }
+
+    mode_t apply(mode_t mode, bool isDir) const {
+        const mode_t setIdBits = S_ISUID | S_ISGID;
+        if (absolute) {
+            if (isDir && !clearsDirSetId) return absoluteMode | (mode & setIdBits);
+            return absoluteMode;
+        }
+        for (const Clause& c : clauses) {
+            mode_t bits = c.perms;
+            if (c.conditionalExec && (isDir || (mode & (S_IXUSR | S_IXGRP | S_IXOTH))))
+                bits |= S_IXUSR | S_IXGRP | S_IXOTH;
+            bits &= c.who & ~c.umaskBits;
+            if (c.op == '+') mode |= bits;
+            else if (c.op == '-') mode &= ~bits;
+            else {
+                mode_t cleared = c.who;
+                if (isDir && !c.namesSetId) cleared &= ~setIdBits;
+                mode = (mode & ~cleared) | bits;
+            }
+        }
+        return mode;
+    }
+};
+
+class BulkMetadataEditor {
+public:
+    enum Operation { CHMOD, CHOWN, TOUCH };
+
+    Operation operation = CHMOD;
+    PermissionSpec permissions;
+    uid_t owner = (uid_t)-1;
+    gid_t group = (gid_t)-1;
+    bool touchNow = true;
+    struct timespec touchTime = {0, 0};
+
+    atomic<long long> changed{0};
+    atomic<long long> unchanged{0};
+    atomic<long long> failed{0};
+    vector<string> failures;
+
+    // Walks root with a pool of worker threads. Each worker reads one directory,
+    // lstats its entries relative to the directory fd and applies the operation
+    // with the *at() calls and AT_SYMLINK_NOFOLLOW. A subdirectory is queued as
+    // its parent's handle plus its name and only opened, with openat(O_NOFOLLOW),
+    // when a worker takes it, so a directory swapped for a symlink mid-walk is
+    // never followed and open fds stay bounded by the directories being read
+    // and the parents of queued entries. The queue is taken depth-first to keep
+    // that parent set small. The target itself is resolved first, so a symlink
+    // given as the target is followed as in chmod(1).
+    void run(const string& target, const string& pattern, bool recursive) {
+        changed = 0;
+        unchanged = 0;
+        failed = 0;
+        failures.clear();
+        namePattern = pattern.empty() ? "*" : pattern;
+        descend = recursive;
+
+        char* resolved = realpath(target.c_str(), nullptr);
+        if (!resolved) {
+            recordFailure(target);
+            return;
+        }
+        string root = resolved;
+        free(resolved);
+        struct stat rootStat;
+        if (fstatat(AT_FDCWD, root.c_str(), &rootStat, AT_SYMLINK_NOFOLLOW) != 0) {
+            recordFailure(root);
+            return;
+        }
+        // The target itself is changed too, like chmod -R / chown -R, when it matches.
+        size_t slash = root.find_last_of('/');
+        string rootName = (slash == string::npos) ? root : root.substr(slash + 1);
+        if (pattern.empty() || fnmatch(namePattern.c_str(), rootName.c_str(), 0) == 0) {
+            applyAt(AT_FDCWD, root.c_str(), "", rootStat);
+        }
+        if (!S_ISDIR(rootStat.st_mode)) return;
+
+        pending.clear();
+        pending.push_back({nullptr, root});
+        busy = 0;
+        unsigned workerCount = thread::hardware_concurrency();
+        if (workerCount == 0) workerCount = 4;
+        vector<thread> workers;
+        for (unsigned i = 0; i < workerCount; ++i) {
+            try {
+                workers.emplace_back(&BulkMetadataEditor::worker, this);
+            } catch (const system_error&) {
+                break;
+            }
+        }
+        if (workers.empty()) worker();
+        for (thread& t : workers) t.join();
+    }
+
+    string describe() const {
+        if (operation == CHMOD) return "chmod";
+        if (operation == CHOWN) return "chown";
+        return "touch";
+    }
+
+private:
+    string namePattern = "*";
+    bool descend = true;
+    struct OpenDirectory {
+        DIR* dir;
+        string path;
+        ~OpenDirectory() { closedir(dir); }
+    };
+
+    // parent is null for the root, whose name is then its full path.
+    struct PendingDirectory {
+        shared_ptr<OpenDirectory> parent;
+        string name;
+    };
+
+    deque<PendingDirectory> pending;
+    int busy = 0;
+    mutex queueMutex;
+    condition_variable queueReady;
+    mutex failureMutex;
+
+    void worker() {
+        while (true) {
+            PendingDirectory next;
+            {
+                unique_lock<mutex> lock(queueMutex);
+                queueReady.wait(lock, [this] { return !pending.empty() || busy == 0; });
+                if (pending.empty()) return;
+                next = move(pending.back());
+                pending.pop_back();
+                busy++;
+            }
+            processDirectory(next);
+            {
+                lock_guard<mutex> lock(queueMutex);
+                busy--;
+                if (busy == 0 && pending.empty()) queueReady.notify_all();
+            }
+        }
+    }
+
+    void processDirectory(PendingDirectory& next) {
+        int parentFd = next.parent ? dirfd(next.parent->dir) : AT_FDCWD;
+        string parentPath = next.parent ? next.parent->path : "";
+        int dirFd = openat(parentFd, next.name.c_str(), O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+        next.parent.reset();
+        if (dirFd < 0) {
+            recordFailure(parentPath, next.name.c_str());
+            return;
+        }
+        DIR* dir = fdopendir(dirFd);
+        if (!dir) {
+            recordFailure(parentPath, next.name.c_str());
+            close(dirFd);
+            return;
+        }
+        auto current = make_shared<OpenDirectory>();
+        current->dir = dir;
+        current->path = parentPath.empty() ? next.name : parentPath + "/" + next.name;
+        const string& path = current->path;
+
+        struct dirent* entry;
+        struct stat fileStat;
+        while ((entry = readdir(dir)) != NULL) {
+            if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
+            if (fstatat(dirFd, entry->d_name, &fileStat, AT_SYMLINK_NOFOLLOW) != 0) {
+                recordFailure(path, entry->d_name);
+                continue;
+            }
+            if (fnmatch(namePattern.c_str(), entry->d_name, 0) == 0) {
+                applyAt(dirFd, entry->d_name, path, fileStat);
+            }
+            if (descend && S_ISDIR(fileStat.st_mode)) {
+                lock_guard<mutex> lock(queueMutex);
+                pending.push_back({current, entry->d_name});
+                queueReady.notify_one();
+            }
+        }
+    }
+
+    // dirPath is empty when name is already a full path (the walk's root).
+    void applyAt(int dirFd, const char* name, const string& dirPath, const struct stat& fileStat) {
+        int result = 0;
+        if (operation == CHMOD) {
+            // Permission bits of a symlink itself are meaningless on Linux.
+            if (S_ISLNK(fileStat.st_mode)) return;
+            mode_t oldMode = fileStat.st_mode & 07777;
+            mode_t newMode = permissions.apply(oldMode, S_ISDIR(fileStat.st_mode));
+            if (newMode == oldMode) {
+                unchanged++;
+                return;
+            }
+            result = fchmodat(dirFd, name, newMode, AT_SYMLINK_NOFOLLOW);
+            // The entry was replaced by a symlink after it was stat'ed; leave it alone.
+            if (result != 0 && (errno == ENOTSUP || errno == EOPNOTSUPP)) return;
+        } else if (operation == CHOWN) {
+            if ((owner == (uid_t)-1 || fileStat.st_uid == owner) &&
+                (group == (gid_t)-1 || fileStat.st_gid == group)) {
+                unchanged++;
+                return;
+            }
+            result = fchownat(dirFd, name, owner, group, AT_SYMLINK_NOFOLLOW);
+        } else {
+            struct timespec times[2];
+            if (touchNow) {
+                times[0].tv_sec = times[1].tv_sec = 0;
+                times[0].tv_nsec = times[1].tv_nsec = UTIME_NOW;
+            } else {
+                if (fileStat.st_atim.tv_sec == touchTime.tv_sec && fileStat.st_atim.tv_nsec == touchTime.tv_nsec &&
+                    fileStat.st_mtim.tv_sec == touchTime.tv_sec && fileStat.st_mtim.tv_nsec == touchTime.tv_nsec) {
+                    unchanged++;
+                    return;
+                }
+                times[0] = times[1] = touchTime;
+            }
+            result = utimensat(dirFd, name, times, AT_SYMLINK_NOFOLLOW);
+        }
+        if (result == 0) changed++;
+        else recordFailure(dirPath, name);
+    }
+
+    void recordFailure(const string& dirPath, const char* name = nullptr) {
+        int err = errno;
+        failed++;
+        lock_guard<mutex> lock(failureMutex);
+        if (failures.size() >= 10) return;
+        string path = !name ? dirPath : dirPath.empty() ? string(name) : dirPath + "/" + name;
+        failures.push_back(path + " (" + strerror(err) + ")");
+    }
+};
+
 class FileExplorer {
 private:
     string currentPath;
     ActivityLogger logger;
     FileStatistics stats;
+    BulkMetadataEditor bulkEditor;
 
     void displayHeader() {
         cout << "\n========================\n";
@@ -162,6 +563,7 @@ private:
         cout << "15. View Activity History\n";
         cout << "16. Advanced Search (with filters)\n";
         cout << "17. Compare Two Files\n";
+        cout << "18. Bulk Permissions / Owner / Timestamps\n";
         cout << "0.  Exit\n";
     }
 
@@ -169,6 +571,15 @@ private:
         cin.ignore(numeric_limits<streamsize>::max(), '\n');
     }
 
+    // Parses a numeric uid/gid. The all-ones value is rejected because
+    // chown treats it as "leave unchanged".
+    bool parseNumericId(const string& text, unsigned long invalidId, unsigned long& id) {
+        if (text.empty() || text.find_first_not_of("0123456789") != string::npos) return false;
+        errno = 0;
+        id = strtoul(text.c_str(), nullptr, 10);
+        return errno != ERANGE && id < invalidId;
+    }
+
 public:
     FileExplorer() {
         char cwd[1024];
@@ -379,32 +790,13 @@ public:
         }
         cout << "\nSearching in: " << currentPath << "\n";
         cout << string(70, '-') << "\n";
-        bool found = false;
-        searchInDirectory(currentPath, searchName, found);
-        if (!found) cout << "No matches found.\n";
+        NameSearchVisitor visitor{searchName};
+        traverseDirectory(currentPath, visitor);
+        if (!visitor.found) cout << "No matches found.\n";
         cout << string(70, '-') << "\n";
         logger.logActivity("Searched for: " + searchName);
     }
 
-    void searchInDirectory(const string& path, const string& searchName, bool& found) {
-        DIR* dir = opendir(path.c_str());
-        if (!dir) return;
-        struct dirent* entry;
-        struct stat fileStat;
-        while ((entry = readdir(dir)) != NULL) {
-            if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
-            string fullPath = path + "/" + entry->d_name;
-            if (string(entry->d_name).find(searchName) != string::npos) {
-                cout << "Found: " << fullPath << "\n";
-                found = true;
-            }
-            if (stat(fullPath.c_str(), &fileStat) == 0 && S_ISDIR(fileStat.st_mode)) {
-                searchInDirectory(fullPath, searchName, found);
-            }
-        }
-        closedir(dir);
-    }
-
     void viewPermissions() {
         cout << "\nEnter file name: ";
         clearInput();
@@ -461,6 +853,102 @@ public:
         }
     }
 
+    void bulkMetadata() {
+        cout << "\nBULK PERMISSIONS / OWNER / TIMESTAMPS\n";
+        clearInput();
+        cout << "Enter target file or directory (Enter for current directory): ";
+        string target;
+        getline(cin, target);
+        string root = currentPath;
+        if (!target.empty()) root = (target[0] == '/') ? target : currentPath + "/" + target;
+        cout << "Name pattern to match (e.g., *.sh, Enter for all): ";
+        string pattern;
+        getline(cin, pattern);
+        cout << "Recurse into subdirectories? (y/n): ";
+        string answer;
+        getline(cin, answer);
+        bool recursive = !answer.empty() && (answer[0] == 'y' || answer[0] == 'Y');
+        cout << "Operation: 1) chmod  2) chown  3) touch: ";
+        string choice;
+        getline(cin, choice);
+
+        string detail;
+        if (choice == "1") {
+            cout << "Enter mode (octal like 755, or symbolic like u+x,go-w,a+X; +x alone honours the umask): ";
+            getline(cin, detail);
+            if (!bulkEditor.permissions.parse(detail)) {
+                cout << "Invalid mode.\n";
+                return;
+            }
+            bulkEditor.operation = BulkMetadataEditor::CHMOD;
+        } else if (choice == "2") {
+            cout << "Enter owner as user, user:group or :group: ";
+            getline(cin, detail);
+            size_t colon = detail.find(':');
+            string user = detail.substr(0, colon);
+            string grp = (colon == string::npos) ? "" : detail.substr(colon + 1);
+            bulkEditor.owner = (uid_t)-1;
+            bulkEditor.group = (gid_t)-1;
+            if (!user.empty()) {
+                struct passwd* pw = getpwnam(user.c_str());
+                unsigned long id;
+                if (pw) bulkEditor.owner = pw->pw_uid;
+                else if (parseNumericId(user, (uid_t)-1, id)) bulkEditor.owner = (uid_t)id;
+                else {
+                    cout << "Unknown user: " << user << "\n";
+                    return;
+                }
+            }
+            if (!grp.empty()) {
+                struct group* gr = getgrnam(grp.c_str());
+                unsigned long id;
+                if (gr) bulkEditor.group = gr->gr_gid;
+                else if (parseNumericId(grp, (gid_t)-1, id)) bulkEditor.group = (gid_t)id;
+                else {
+                    cout << "Unknown group: " << grp << "\n";
+                    return;
+                }
+            }
+            if (user.empty() && grp.empty()) {
+                cout << "No owner provided.\n";
+                return;
+            }
+            bulkEditor.operation = BulkMetadataEditor::CHOWN;
+        } else if (choice == "3") {
+            cout << "Enter timestamp (YYYY-MM-DD HH:MM, Enter for now): ";
+            getline(cin, detail);
+            bulkEditor.touchNow = detail.empty();
+            if (!bulkEditor.touchNow) {
+                struct tm tmTime = {};
+                if (!strptime(detail.c_str(), "%Y-%m-%d %H:%M", &tmTime)) {
+                    cout << "Invalid timestamp.\n";
+                    return;
+                }
+                tmTime.tm_isdst = -1;
+                bulkEditor.touchTime.tv_sec = mktime(&tmTime);
+                bulkEditor.touchTime.tv_nsec = 0;
+            } else {
+                detail = "now";
+            }
+            bulkEditor.operation = BulkMetadataEditor::TOUCH;
+        } else {
+            cout << "Invalid operation.\n";
+            return;
+        }
+
+        cout << "\nApplying " << bulkEditor.describe() << " " << detail << "...\n";
+        cout << string(70, '-') << "\n";
+        bulkEditor.run(root, pattern, recursive);
+        for (const string& failure : bulkEditor.failures) cout << "Failed: " << failure << "\n";
+        cout << "Changed: " << bulkEditor.changed << "  Unchanged: " << bulkEditor.unchanged
+             << "  Failed: " << bulkEditor.failed << "\n";
+        cout << string(70, '-') << "\n";
+        logger.logActivity("Bulk " + bulkEditor.describe() + " " + detail + " on " + root +
+                           " (pattern " + (pattern.empty() ? "*" : pattern) + (recursive ? ", recursive" : "") + "): " +
+                           to_string(bulkEditor.changed) + " changed, " + to_string(bulkEditor.unchanged) +
+                           " unchanged, " + to_string(bulkEditor.failed) + " failed");
+    }
+
     void viewFileContent() {
         cout << "\nEnter file name: ";
         clearInput();
@@ -524,39 +1012,24 @@ public:
 
         cout << "\nSearching with filters...\n";
         cout << string(70, '-') << "\n";
-        bool found = false;
-        advancedSearchInDirectory(currentPath, pattern.empty() ? "*" : pattern, extension, minSize, maxSize, found);
+        if (pattern.empty()) pattern = "*";
+        bool filterName = pattern != "*";
+        bool filterExt = !extension.empty();
+        bool found;
+        if (filterName && filterExt) found = runAdvancedSearch<true, true>(pattern, extension, minSize, maxSize);
+        else if (filterName) found = runAdvancedSearch<true, false>(pattern, extension, minSize, maxSize);
+        else if (filterExt) found = runAdvancedSearch<false, true>(pattern, extension, minSize, maxSize);
+        else found = runAdvancedSearch<false, false>(pattern, extension, minSize, maxSize);
         if (!found) cout << "No files found matching criteria.\n";
         cout << string(70, '-') << "\n";
         logger.logActivity("Advanced search performed");
     }
 
-    void advancedSearchInDirectory(const string& path, const string& pattern,
-                                   const string& ext, long long minSize, long long maxSize, bool& found) {
-        DIR* dir = opendir(path.c_str());
-        if (!dir) return;
-        struct dirent* entry;
-        struct stat fileStat;
-        while ((entry = readdir(dir)) != NULL) {
-            if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
-            string fullPath = path + "/" + entry->d_name;
-            string name = entry->d_name;
-            if (stat(fullPath.c_str(), &fileStat) == 0) {
-                if (S_ISREG(fileStat.st_mode)) {
-                    bool matches = true;
-                    if (pattern != "*" && !pattern.empty() && name.find(pattern) == string::npos) matches = false;
-                    if (!ext.empty() && name.find(ext) == string::npos) matches = false;
-                    if (fileStat.st_size < minSize || fileStat.st_size > maxSize) matches = false;
-                    if (matches) {
-                        cout << fullPath << " (" << stats.formatSize(fileStat.st_size) << ")\n";
-                        found = true;
-                    }
-                } else if (S_ISDIR(fileStat.st_mode)) {
-                    advancedSearchInDirectory(fullPath, pattern, ext, minSize, maxSize, found);
-                }
-            }
-        }
-        closedir(dir);
+    template <bool FilterName, bool FilterExt>
+    bool runAdvancedSearch(const string& pattern, const string& ext, long long minSize, long long maxSize) {
+        AdvancedSearchVisitor<FilterName, FilterExt> visitor{pattern, ext, minSize, maxSize, stats};
+        traverseDirectory(currentPath, visitor);
+        return visitor.found;
     }
 
     void compareFiles() {
@@ -657,6 +1130,7 @@ public:
                 case 15: viewActivityHistory(); break;
                 case 16: advancedSearch(); break;
                 case 17: compareFiles(); break;
+                case 18: bulkMetadata(); break;
                 case 0:
                     cout << "\nThank you for using File Explorer Application.\n";
                     logger.logActivity("Application closed");